@@ -1,10 +1,95 @@
 // SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
 // SPDX-License-Identifier: BSD-3-Clause
 
+#include <vtkDataArray.h>
+#include <vtkMath.h>
 #include <vtkMinimalStandardRandomSequence.h>
+#include <vtkPointData.h>
 #include <vtkSmartPointer.h>
 #include <vtkTexturedSphereSource.h>
 
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+int TestIcosahedronSubdivision(int level)
+{
+  vtkSmartPointer<vtkTexturedSphereSource> source =
+    vtkSmartPointer<vtkTexturedSphereSource>::New();
+  source->SetTessellationModeToIcosahedronSubdivision();
+  source->SetSubdivisionLevel(level);
+  source->Update();
+
+  vtkPolyData* polyData = source->GetOutput();
+
+  // Level L subdivides each of the 20 base faces into 4^L triangles.
+  vtkIdType expectedPolys = 20;
+  for (int l = 0; l < level; l++)
+  {
+    expectedPolys *= 4;
+  }
+  if (polyData->GetNumberOfCells() != expectedPolys)
+  {
+    return EXIT_FAILURE;
+  }
+
+  vtkDataArray* normals = polyData->GetPointData()->GetNormals();
+  vtkDataArray* tcoords = polyData->GetPointData()->GetTCoords();
+  const vtkIdType numPts = polyData->GetNumberOfPoints();
+  if (!normals || normals->GetNumberOfTuples() != numPts || !tcoords ||
+    tcoords->GetNumberOfTuples() != numPts)
+  {
+    return EXIT_FAILURE;
+  }
+
+  for (vtkIdType k = 0; k < numPts; k++)
+  {
+    double n[3];
+    normals->GetTuple(k, n);
+    if (std::fabs(vtkMath::Norm(n) - 1.0) > 1.0e-6)
+    {
+      return EXIT_FAILURE;
+    }
+    double tc[2];
+    tcoords->GetTuple(k, tc);
+    // Points duplicated across the u=0 seam carry u+1 with u < 0.5.
+    if (tc[0] < 0.0 || tc[0] > 1.5 || tc[1] < 0.0 || tc[1] > 1.0)
+    {
+      return EXIT_FAILURE;
+    }
+  }
+
+  // No triangle may interpolate u across more than half the texture; the
+  // seam and pole fix-ups exist to guarantee this.
+  for (vtkIdType cellId = 0; cellId < polyData->GetNumberOfCells(); cellId++)
+  {
+    vtkIdType npts;
+    const vtkIdType* cellPts;
+    polyData->GetCellPoints(cellId, npts, cellPts);
+    if (npts != 3)
+    {
+      return EXIT_FAILURE;
+    }
+    double uMin = 2.0;
+    double uMax = -1.0;
+    for (vtkIdType c = 0; c < npts; c++)
+    {
+      double tc[2];
+      tcoords->GetTuple(cellPts[c], tc);
+      uMin = std::min(uMin, tc[0]);
+      uMax = std::max(uMax, tc[0]);
+    }
+    if (uMax - uMin > 0.5 + 1.0e-6)
+    {
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
+}
+
 int TestTexturedSphereSource(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
 {
   vtkSmartPointer<vtkMinimalStandardRandomSequence> randomSequence =
@@ -50,5 +135,13 @@ int TestTexturedSphereSource(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
     return EXIT_FAILURE;
   }
 
+  for (int level = 0; level < 3; level++)
+  {
+    if (TestIcosahedronSubdivision(level) != EXIT_SUCCESS)
+    {
+      return EXIT_FAILURE;
+    }
+  }
+
   return EXIT_SUCCESS;
 }
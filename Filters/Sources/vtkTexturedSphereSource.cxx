@@ -3,7 +3,9 @@
 #include "vtkTexturedSphereSource.h"
 
 #include "vtkCellArray.h"
+#include "vtkDoubleArray.h"
 #include "vtkFloatArray.h"
+#include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
@@ -11,10 +13,251 @@
 #include "vtkPointData.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkTexturedSphereSource);
 
+namespace
+{
+// Compute sin and cos of the same angle in one call where the C library
+// supports it (glibc's sincos shares the argument reduction between the
+// two results); elsewhere fall back to separate evaluations.
+inline void vtkSphereSinCos(double angle, double& sinValue, double& cosValue)
+{
+#if defined(__GLIBC__)
+  sincos(angle, &sinValue, &cosValue);
+#else
+  sinValue = sin(angle);
+  cosValue = cos(angle);
+#endif
+}
+
+inline void vtkSphereSinCos(float angle, float& sinValue, float& cosValue)
+{
+#if defined(__GLIBC__)
+  sincosf(angle, &sinValue, &cosValue);
+#else
+  sinValue = sinf(angle);
+  cosValue = cosf(angle);
+#endif
+}
+
+// Fill the UV sphere's points, normals, and texture coordinates.
+// Instantiated for float and double so that a single-precision output runs
+// the whole pipeline -- tables, products, and stores -- in single
+// precision instead of computing in double and truncating on store.
+template <typename T>
+void vtkGenerateUVSpherePointData(T* pts, float* normals, float* tcoords, double radius,
+  int thetaResolution, int phiResolution)
+{
+  int i, j;
+
+  // phi depends only on j and theta only on i, so evaluate the
+  // transcendentals once per ring instead of once per vertex. The
+  // generation loops below then reduce to table lookups and multiplies.
+  const T sphereRadius = static_cast<T>(radius);
+  const T deltaPhi = static_cast<T>(vtkMath::Pi()) / phiResolution;
+  const T deltaTheta = 2 * static_cast<T>(vtkMath::Pi()) / thetaResolution;
+  std::vector<T> sinPhi(phiResolution + 1), cosPhi(phiResolution + 1);
+  std::vector<T> sinTheta(thetaResolution + 1), cosTheta(thetaResolution + 1);
+  for (j = 0; j <= phiResolution; j++)
+  {
+    vtkSphereSinCos(j * deltaPhi, sinPhi[j], cosPhi[j]);
+  }
+  for (i = 0; i <= thetaResolution; i++)
+  {
+    vtkSphereSinCos(i * deltaTheta, sinTheta[i], cosTheta[i]);
+  }
+
+  // The point, normal, and tcoord fills run as separate passes so that
+  // each inner loop is a branch-free, stride-1 kernel of table loads and
+  // multiplies with the per-ring theta terms held in registers -- a shape
+  // the compiler can vectorize. Each ring writes a disjoint slice of the
+  // output arrays, so the passes also parallelize over theta with no
+  // synchronization.
+  auto fillRings = [&](vtkIdType ringBegin, vtkIdType ringEnd) {
+    for (vtkIdType ring = ringBegin; ring < ringEnd; ring++)
+    {
+      const T ct = cosTheta[ring];
+      const T st = sinTheta[ring];
+      T* p = pts + 3 * ring * (phiResolution + 1);
+      for (int jj = 0; jj <= phiResolution; jj++)
+      {
+        // Store each component straight into the points buffer; staging
+        // the vertex in a local array would just add stores and reloads
+        // the compiler cannot always elide.
+        const T r = sphereRadius * sinPhi[jj];
+        p[3 * jj] = r * ct;
+        p[3 * jj + 1] = r * st;
+        p[3 * jj + 2] = sphereRadius * cosPhi[jj];
+      }
+    }
+    // (sinPhi*cosTheta, sinPhi*sinTheta, cosPhi) is unit length by
+    // construction, so the normals need no normalization -- no square
+    // root, divides, or zero-length test per vertex.
+    for (vtkIdType ring = ringBegin; ring < ringEnd; ring++)
+    {
+      const T ct = cosTheta[ring];
+      const T st = sinTheta[ring];
+      float* n = normals + 3 * ring * (phiResolution + 1);
+      for (int jj = 0; jj <= phiResolution; jj++)
+      {
+        n[3 * jj] = static_cast<float>(sinPhi[jj] * ct);
+        n[3 * jj + 1] = static_cast<float>(sinPhi[jj] * st);
+        n[3 * jj + 2] = static_cast<float>(cosPhi[jj]);
+      }
+    }
+    for (vtkIdType ring = ringBegin; ring < ringEnd; ring++)
+    {
+      const float u = static_cast<float>(ring) / thetaResolution;
+      float* t = tcoords + 2 * ring * (phiResolution + 1);
+      for (int jj = 0; jj <= phiResolution; jj++)
+      {
+        t[2 * jj] = u;
+        t[2 * jj + 1] = 1.0f - static_cast<float>(jj) / phiResolution;
+      }
+    }
+  };
+
+  // Stay serial for small meshes, where the parallel dispatch overhead
+  // outweighs the work.
+  const vtkIdType numPts = static_cast<vtkIdType>(thetaResolution + 1) * (phiResolution + 1);
+  if (numPts < 4096)
+  {
+    fillRings(0, thetaResolution + 1);
+  }
+  else
+  {
+    vtkSMPTools::For(0, thetaResolution + 1, fillRings);
+  }
+}
+
+// Forward to the generation kernel with the resolutions fixed at compile
+// time. The kernel lives in this translation unit, so each instantiation
+// inlines it with constant trip counts, letting the compiler unroll the
+// rings and fold the table indexing for the preset.
+template <int Resolution, typename T>
+void vtkGenerateUVSpherePointDataFixed(T* pts, float* normals, float* tcoords, double radius)
+{
+  vtkGenerateUVSpherePointData(pts, normals, tcoords, radius, Resolution, Resolution);
+}
+
+// Dispatch to a specialized instantiation for the common square presets
+// (the default constructor and most callers use equal resolutions of 8,
+// 16, or 32); everything else takes the runtime-sized kernel.
+template <typename T>
+void vtkDispatchUVSpherePointData(T* pts, float* normals, float* tcoords, double radius,
+  int thetaResolution, int phiResolution)
+{
+  if (thetaResolution == phiResolution)
+  {
+    switch (phiResolution)
+    {
+      case 8:
+        vtkGenerateUVSpherePointDataFixed<8>(pts, normals, tcoords, radius);
+        return;
+      case 16:
+        vtkGenerateUVSpherePointDataFixed<16>(pts, normals, tcoords, radius);
+        return;
+      case 32:
+        vtkGenerateUVSpherePointDataFixed<32>(pts, normals, tcoords, radius);
+        return;
+      default:
+        break;
+    }
+  }
+  vtkGenerateUVSpherePointData(pts, normals, tcoords, radius, thetaResolution, phiResolution);
+}
+
+// The unit-sphere point pattern, normals, tcoords, and connectivity depend
+// only on the resolutions and the point precision -- not on Radius, which
+// applications commonly animate. Cache the generated unit meshes
+// process-wide so a re-execution that only changed Radius reduces to a
+// scale of the cached points.
+struct vtkSphereCacheKey
+{
+  int PhiResolution;
+  int ThetaResolution;
+  int Precision;
+
+  bool operator==(const vtkSphereCacheKey& other) const
+  {
+    return this->PhiResolution == other.PhiResolution &&
+      this->ThetaResolution == other.ThetaResolution && this->Precision == other.Precision;
+  }
+};
+
+struct vtkSphereCacheKeyHash
+{
+  size_t operator()(const vtkSphereCacheKey& key) const
+  {
+    return (static_cast<size_t>(key.PhiResolution) * 31 + key.ThetaResolution) * 31 +
+      key.Precision;
+  }
+};
+
+struct vtkSphereCacheEntry
+{
+  vtkSmartPointer<vtkDataArray> UnitPoints;
+  vtkSmartPointer<vtkFloatArray> Normals;
+  vtkSmartPointer<vtkFloatArray> TCoords;
+  vtkSmartPointer<vtkCellArray> Strips;
+  uint64_t LastUse = 0;
+};
+
+constexpr size_t vtkSphereCacheCapacity = 16;
+std::mutex vtkSphereCacheMutex;
+uint64_t vtkSphereCacheClock = 0;
+std::unordered_map<vtkSphereCacheKey, vtkSphereCacheEntry, vtkSphereCacheKeyHash> vtkSphereCache;
+
+// Look up a cached unit mesh; the returned entry's UnitPoints is null on a
+// miss.
+vtkSphereCacheEntry vtkSphereCacheFind(const vtkSphereCacheKey& key)
+{
+  std::lock_guard<std::mutex> lock(vtkSphereCacheMutex);
+  auto it = vtkSphereCache.find(key);
+  if (it == vtkSphereCache.end())
+  {
+    return vtkSphereCacheEntry();
+  }
+  it->second.LastUse = ++vtkSphereCacheClock;
+  return it->second;
+}
+
+// Insert a freshly generated unit mesh, evicting the least recently used
+// entry when the cache is full.
+void vtkSphereCacheInsert(const vtkSphereCacheKey& key, const vtkSphereCacheEntry& entry)
+{
+  std::lock_guard<std::mutex> lock(vtkSphereCacheMutex);
+  const bool isNewKey = vtkSphereCache.find(key) == vtkSphereCache.end();
+  if (vtkSphereCache.size() >= vtkSphereCacheCapacity && isNewKey)
+  {
+    auto oldest = vtkSphereCache.begin();
+    for (auto it = vtkSphereCache.begin(); it != vtkSphereCache.end(); ++it)
+    {
+      if (it->second.LastUse < oldest->second.LastUse)
+      {
+        oldest = it;
+      }
+    }
+    vtkSphereCache.erase(oldest);
+  }
+  vtkSphereCacheEntry& stored = vtkSphereCache[key];
+  stored = entry;
+  stored.LastUse = ++vtkSphereCacheClock;
+}
+} // anonymous namespace
+
 // Construct sphere with radius=0.5 and default resolution 8 in both Phi
 // and Theta directions.
 vtkTexturedSphereSource::vtkTexturedSphereSource(int res)
@@ -25,6 +268,8 @@ vtkTexturedSphereSource::vtkTexturedSphereSource(int res)
   this->PhiResolution = res;
   this->Theta = 0.0;
   this->Phi = 0.0;
+  this->TessellationMode = UV_SPHERE;
+  this->SubdivisionLevel = 2;
   this->OutputPointsPrecision = SINGLE_PRECISION;
 
   this->SetNumberOfInputPorts(0);
@@ -39,112 +284,397 @@ int vtkTexturedSphereSource::RequestData(vtkInformation* vtkNotUsed(request),
   // get the output
   vtkPolyData* output = vtkPolyData::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
 
-  int i, j;
-  int numPts;
-  int numPolys;
+  if (this->TessellationMode == ICOSAHEDRON_SUBDIVISION)
+  {
+    this->GenerateIcosahedralSphere(output);
+    return 1;
+  }
+
+  vtkIdType numPts;
+  vtkIdType numStrips;
   vtkPoints* newPoints;
-  vtkFloatArray* newNormals;
-  vtkFloatArray* newTCoords;
-  vtkCellArray* newPolys;
-  double x[3], deltaPhi, deltaTheta, phi, theta, radius, norm;
-  vtkIdType pts[3];
-  double tc[2];
+
+  numPts = static_cast<vtkIdType>(this->PhiResolution + 1) * (this->ThetaResolution + 1);
+  // creating one triangle strip per theta band
+  numStrips = this->ThetaResolution;
+
+  const int pointType =
+    this->OutputPointsPrecision == vtkAlgorithm::DOUBLE_PRECISION ? VTK_DOUBLE : VTK_FLOAT;
 
   //
-  // Set things up; allocate memory
+  // Look up the unit mesh for these resolutions, generating and caching it
+  // on a miss. Only the points depend on Radius, and only by a uniform
+  // scale, so the cached normals, tcoords, and connectivity are reused
+  // unchanged and a Radius-only re-execution reduces to one scale pass.
   //
+  const vtkSphereCacheKey key = { this->PhiResolution, this->ThetaResolution, pointType };
+  vtkSphereCacheEntry entry = vtkSphereCacheFind(key);
+  if (!entry.UnitPoints)
+  {
+    // The number of points is known exactly, so size the arrays up front
+    // and write through raw pointers rather than paying the bounds check
+    // and virtual dispatch of InsertNextPoint()/InsertNextTuple() per
+    // vertex.
+    if (pointType == VTK_DOUBLE)
+    {
+      entry.UnitPoints = vtkSmartPointer<vtkDoubleArray>::New();
+    }
+    else
+    {
+      entry.UnitPoints = vtkSmartPointer<vtkFloatArray>::New();
+    }
+    entry.UnitPoints->SetNumberOfComponents(3);
+    entry.UnitPoints->SetNumberOfTuples(numPts);
+    entry.Normals = vtkSmartPointer<vtkFloatArray>::New();
+    entry.Normals->SetNumberOfComponents(3);
+    entry.Normals->SetNumberOfTuples(numPts);
+    entry.TCoords = vtkSmartPointer<vtkFloatArray>::New();
+    entry.TCoords->SetNumberOfComponents(2);
+    entry.TCoords->SetNumberOfTuples(numPts);
 
-  numPts = (this->PhiResolution + 1) * (this->ThetaResolution + 1);
-  // creating triangles
-  numPolys = this->PhiResolution * 2 * this->ThetaResolution;
+    //
+    // Create sphere
+    //
+    // Dispatch on the output precision: the single-precision path runs its
+    // trig and products in float rather than computing in double and
+    // truncating on store.
+    float* normals = entry.Normals->GetPointer(0);
+    float* tcoords = entry.TCoords->GetPointer(0);
+    if (pointType == VTK_DOUBLE)
+    {
+      vtkDispatchUVSpherePointData(
+        static_cast<vtkDoubleArray*>(entry.UnitPoints.GetPointer())->GetPointer(0), normals,
+        tcoords, 1.0, this->ThetaResolution, this->PhiResolution);
+    }
+    else
+    {
+      vtkDispatchUVSpherePointData(
+        static_cast<vtkFloatArray*>(entry.UnitPoints.GetPointer())->GetPointer(0), normals,
+        tcoords, 1.0, this->ThetaResolution, this->PhiResolution);
+    }
+    //
+    // Generate mesh connectivity
+    //
+    // Each theta band becomes one triangle strip zig-zagging between its
+    // two point rings. Independent triangles referenced every interior
+    // point six times; the strips reference each point twice, halving the
+    // connectivity memory and improving vertex-cache locality in the
+    // mapper. The offsets and connectivity are written as two prebuilt
+    // arrays and handed to the cell array in a single SetData() call; the
+    // indices are affine in i and j, so these loops vectorize, and the
+    // per-cell InsertNextCell bookkeeping disappears entirely.
+    const vtkIdType stripLength = 2 * (this->PhiResolution + 1);
+    vtkIdTypeArray* offsets = vtkIdTypeArray::New();
+    offsets->SetNumberOfValues(numStrips + 1);
+    vtkIdTypeArray* connectivity = vtkIdTypeArray::New();
+    connectivity->SetNumberOfValues(numStrips * stripLength);
+    vtkIdType* offsetsPtr = offsets->GetPointer(0);
+    for (vtkIdType c = 0; c <= numStrips; c++)
+    {
+      offsetsPtr[c] = c * stripLength;
+    }
+    vtkIdType* conn = connectivity->GetPointer(0);
+    // bands between poles; leading with ring i+1 keeps the triangle
+    // winding of the old independent-triangle output. Each band writes a
+    // disjoint slice of the connectivity, so the fill parallelizes over
+    // theta like the point passes, with the same serial cutoff.
+    auto fillBands = [&](vtkIdType bandBegin, vtkIdType bandEnd) {
+      for (vtkIdType band = bandBegin; band < bandEnd; band++)
+      {
+        const vtkIdType base = band * (this->PhiResolution + 1);
+        const vtkIdType next = base + this->PhiResolution + 1;
+        vtkIdType* c = conn + band * stripLength;
+        for (int j = 0; j <= this->PhiResolution; j++)
+        {
+          c[0] = next + j;
+          c[1] = base + j;
+          c += 2;
+        }
+      }
+    };
+    if (numPts < 4096)
+    {
+      fillBands(0, numStrips);
+    }
+    else
+    {
+      vtkSMPTools::For(0, numStrips, fillBands);
+    }
+    entry.Strips = vtkSmartPointer<vtkCellArray>::New();
+    entry.Strips->SetData(offsets, connectivity);
+    offsets->Delete();
+    connectivity->Delete();
 
-  newPoints = vtkPoints::New();
+    vtkSphereCacheInsert(key, entry);
+  }
 
-  // Set the desired precision for the points in the output.
-  if (this->OutputPointsPrecision == vtkAlgorithm::DOUBLE_PRECISION)
+  //
+  // Produce the output points by scaling the cached unit sphere by Radius.
+  //
+  newPoints = vtkPoints::New();
+  newPoints->SetDataType(pointType);
+  newPoints->SetNumberOfPoints(numPts);
+  if (pointType == VTK_DOUBLE)
   {
-    newPoints->SetDataType(VTK_DOUBLE);
+    const double* src = static_cast<vtkDoubleArray*>(entry.UnitPoints.GetPointer())->GetPointer(0);
+    double* dst = static_cast<vtkDoubleArray*>(newPoints->GetData())->GetPointer(0);
+    for (vtkIdType k = 0; k < 3 * numPts; k++)
+    {
+      dst[k] = this->Radius * src[k];
+    }
   }
   else
   {
-    newPoints->SetDataType(VTK_FLOAT);
+    const float* src = static_cast<vtkFloatArray*>(entry.UnitPoints.GetPointer())->GetPointer(0);
+    float* dst = static_cast<vtkFloatArray*>(newPoints->GetData())->GetPointer(0);
+    const float radius = static_cast<float>(this->Radius);
+    for (vtkIdType k = 0; k < 3 * numPts; k++)
+    {
+      dst[k] = radius * src[k];
+    }
   }
 
-  newPoints->Allocate(numPts);
-  newNormals = vtkFloatArray::New();
-  newNormals->SetNumberOfComponents(3);
-  newNormals->Allocate(3 * numPts);
-  newTCoords = vtkFloatArray::New();
-  newTCoords->SetNumberOfComponents(2);
-  newTCoords->Allocate(2 * numPts);
-  newPolys = vtkCellArray::New();
-  newPolys->AllocateEstimate(numPolys, 3);
   //
-  // Create sphere
+  // Update ourselves and release memory
   //
-  // Create intermediate points
-  deltaPhi = vtkMath::Pi() / this->PhiResolution;
-  deltaTheta = 2.0 * vtkMath::Pi() / this->ThetaResolution;
-  for (i = 0; i <= this->ThetaResolution; i++)
-  {
-    theta = i * deltaTheta;
-    tc[0] = theta / (2.0 * vtkMath::Pi());
-    for (j = 0; j <= this->PhiResolution; j++)
-    {
-      phi = j * deltaPhi;
-      radius = this->Radius * sin((double)phi);
-      x[0] = radius * cos((double)theta);
-      x[1] = radius * sin((double)theta);
-      x[2] = this->Radius * cos((double)phi);
-      newPoints->InsertNextPoint(x);
-
-      if ((norm = vtkMath::Norm(x)) == 0.0)
+  output->SetPoints(newPoints);
+  newPoints->Delete();
+
+  // The normals, tcoords, and connectivity are shared with the cache (and
+  // with any other sphere source at the same resolutions); VTK arrays are
+  // reference counted, and source outputs are read-only to consumers.
+  output->GetPointData()->SetNormals(entry.Normals);
+  output->GetPointData()->SetTCoords(entry.TCoords);
+  output->SetStrips(entry.Strips);
+
+  return 1;
+}
+
+// Subdivide a regular icosahedron, splitting each edge at its midpoint and
+// projecting the new points onto the sphere. Compared to the UV
+// parameterization this avoids the pole fans, giving near-uniform triangle
+// quality with fewer vertices for the same angular resolution.
+void vtkTexturedSphereSource::GenerateIcosahedralSphere(vtkPolyData* output)
+{
+  // Unit icosahedron built from three orthogonal golden-ratio rectangles.
+  const double g = (1.0 + sqrt(5.0)) / 2.0;
+  const double baseVerts[12][3] = {
+    { -1.0, g, 0.0 },
+    { 1.0, g, 0.0 },
+    { -1.0, -g, 0.0 },
+    { 1.0, -g, 0.0 },
+    { 0.0, -1.0, g },
+    { 0.0, 1.0, g },
+    { 0.0, -1.0, -g },
+    { 0.0, 1.0, -g },
+    { g, 0.0, -1.0 },
+    { g, 0.0, 1.0 },
+    { -g, 0.0, -1.0 },
+    { -g, 0.0, 1.0 },
+  };
+  const vtkIdType baseFaces[20][3] = {
+    { 0, 11, 5 },
+    { 0, 5, 1 },
+    { 0, 1, 7 },
+    { 0, 7, 10 },
+    { 0, 10, 11 },
+    { 1, 5, 9 },
+    { 5, 11, 4 },
+    { 11, 10, 2 },
+    { 10, 7, 6 },
+    { 7, 1, 8 },
+    { 3, 9, 4 },
+    { 3, 4, 2 },
+    { 3, 2, 6 },
+    { 3, 6, 8 },
+    { 3, 8, 9 },
+    { 4, 9, 5 },
+    { 2, 4, 11 },
+    { 6, 2, 10 },
+    { 8, 6, 7 },
+    { 9, 8, 1 },
+  };
+
+  std::vector<std::array<double, 3>> unitPts;
+  std::vector<std::array<vtkIdType, 3>> faces;
+  unitPts.reserve(12);
+  const double baseNorm = sqrt(1.0 + g * g);
+  for (const auto& v : baseVerts)
+  {
+    unitPts.push_back({ { v[0] / baseNorm, v[1] / baseNorm, v[2] / baseNorm } });
+  }
+  faces.reserve(20);
+  for (const auto& f : baseFaces)
+  {
+    faces.push_back({ { f[0], f[1], f[2] } });
+  }
+
+  for (int level = 0; level < this->SubdivisionLevel; level++)
+  {
+    // Each edge is shared by two faces; dedupe midpoints by keying the
+    // cache on the sorted endpoint id pair.
+    std::unordered_map<uint64_t, vtkIdType> midpointCache;
+    midpointCache.reserve(3 * faces.size() / 2);
+    auto midpoint = [&](vtkIdType a, vtkIdType b) -> vtkIdType {
+      const uint64_t key = a < b ? (static_cast<uint64_t>(a) << 32) | static_cast<uint64_t>(b)
+                                 : (static_cast<uint64_t>(b) << 32) | static_cast<uint64_t>(a);
+      auto it = midpointCache.find(key);
+      if (it != midpointCache.end())
       {
-        norm = 1.0;
+        return it->second;
       }
-      x[0] /= norm;
-      x[1] /= norm;
-      x[2] /= norm;
-      newNormals->InsertNextTuple(x);
+      const std::array<double, 3>& pa = unitPts[a];
+      const std::array<double, 3>& pb = unitPts[b];
+      std::array<double, 3> m = { { pa[0] + pb[0], pa[1] + pb[1], pa[2] + pb[2] } };
+      const double invNorm = 1.0 / sqrt(m[0] * m[0] + m[1] * m[1] + m[2] * m[2]);
+      m[0] *= invNorm;
+      m[1] *= invNorm;
+      m[2] *= invNorm;
+      const vtkIdType id = static_cast<vtkIdType>(unitPts.size());
+      unitPts.push_back(m);
+      midpointCache.emplace(key, id);
+      return id;
+    };
 
-      tc[1] = 1.0 - phi / vtkMath::Pi();
-      newTCoords->InsertNextTuple(tc);
+    std::vector<std::array<vtkIdType, 3>> newFaces;
+    newFaces.reserve(4 * faces.size());
+    for (const auto& f : faces)
+    {
+      const vtkIdType ab = midpoint(f[0], f[1]);
+      const vtkIdType bc = midpoint(f[1], f[2]);
+      const vtkIdType ca = midpoint(f[2], f[0]);
+      newFaces.push_back({ { f[0], ab, ca } });
+      newFaces.push_back({ { f[1], bc, ab } });
+      newFaces.push_back({ { f[2], ca, bc } });
+      newFaces.push_back({ { ab, bc, ca } });
     }
+    faces.swap(newFaces);
   }
-  //
-  // Generate mesh connectivity
-  //
-  // bands between poles
-  for (i = 0; i < this->ThetaResolution; i++)
+
+  // Texture coordinates from the spherical parameterization, matching the
+  // UV path's convention: u = theta/2pi, v = 1 - phi/pi.
+  std::vector<std::array<float, 2>> tcs(unitPts.size());
+  for (size_t k = 0; k < unitPts.size(); k++)
   {
-    for (j = 0; j < this->PhiResolution; j++)
+    double u = atan2(unitPts[k][1], unitPts[k][0]) / (2.0 * vtkMath::Pi());
+    if (u < 0.0)
     {
-      pts[0] = (this->PhiResolution + 1) * i + j;
-      pts[1] = pts[0] + 1;
-      pts[2] = ((this->PhiResolution + 1) * (i + 1) + j) + 1;
-      newPolys->InsertNextCell(3, pts);
+      u += 1.0;
+    }
+    const double z = vtkMath::ClampValue(unitPts[k][2], -1.0, 1.0);
+    tcs[k] = { { static_cast<float>(u), static_cast<float>(1.0 - acos(z) / vtkMath::Pi()) } };
+  }
 
-      pts[1] = pts[2];
-      pts[2] = pts[1] - 1;
-      newPolys->InsertNextCell(3, pts);
+  // Fix the u=0 seam: triangles straddling it would interpolate u across
+  // nearly the whole texture. When a triangle's u range spans more than
+  // half the texture, remap all its low-u corners to duplicated points
+  // carrying u+1, which brings the span back under one half. The poles
+  // are excluded from the span test since atan2(0, 0) makes their u
+  // arbitrary; they are handled separately below.
+  auto isPole = [&](vtkIdType id) { return fabs(unitPts[id][2]) > 1.0 - 1.0e-12; };
+  std::unordered_map<vtkIdType, vtkIdType> seamDuplicate;
+  for (auto& f : faces)
+  {
+    float uMin = 2.0f;
+    float uMax = -1.0f;
+    for (int c = 0; c < 3; c++)
+    {
+      if (!isPole(f[c]))
+      {
+        uMin = std::min(uMin, tcs[f[c]][0]);
+        uMax = std::max(uMax, tcs[f[c]][0]);
+      }
+    }
+    if (uMax - uMin <= 0.5f)
+    {
+      continue;
+    }
+    for (int c = 0; c < 3; c++)
+    {
+      if (!isPole(f[c]) && tcs[f[c]][0] < 0.5f)
+      {
+        auto it = seamDuplicate.find(f[c]);
+        if (it == seamDuplicate.end())
+        {
+          const vtkIdType dup = static_cast<vtkIdType>(unitPts.size());
+          unitPts.push_back(unitPts[f[c]]);
+          tcs.push_back({ { tcs[f[c]][0] + 1.0f, tcs[f[c]][1] } });
+          it = seamDuplicate.emplace(f[c], dup).first;
+        }
+        f[c] = it->second;
+      }
     }
   }
-  //
-  // Update ourselves and release memory
-  //
+
+  // Give each pole-adjacent triangle its own duplicate of the pole point,
+  // carrying the mean u of the triangle's other two corners, so the
+  // interpolated u stays local to the triangle instead of sweeping toward
+  // the pole's arbitrary value.
+  for (auto& f : faces)
+  {
+    for (int c = 0; c < 3; c++)
+    {
+      if (isPole(f[c]))
+      {
+        const float u = 0.5f * (tcs[f[(c + 1) % 3]][0] + tcs[f[(c + 2) % 3]][0]);
+        const vtkIdType dup = static_cast<vtkIdType>(unitPts.size());
+        unitPts.push_back(unitPts[f[c]]);
+        tcs.push_back({ { u, tcs[f[c]][1] } });
+        f[c] = dup;
+      }
+    }
+  }
+
+  const vtkIdType numPts = static_cast<vtkIdType>(unitPts.size());
+  const vtkIdType numPolys = static_cast<vtkIdType>(faces.size());
+
+  vtkPoints* newPoints = vtkPoints::New();
+  if (this->OutputPointsPrecision == vtkAlgorithm::DOUBLE_PRECISION)
+  {
+    newPoints->SetDataType(VTK_DOUBLE);
+  }
+  else
+  {
+    newPoints->SetDataType(VTK_FLOAT);
+  }
+  newPoints->SetNumberOfPoints(numPts);
+  vtkFloatArray* newNormals = vtkFloatArray::New();
+  newNormals->SetNumberOfComponents(3);
+  newNormals->SetNumberOfTuples(numPts);
+  vtkFloatArray* newTCoords = vtkFloatArray::New();
+  newTCoords->SetNumberOfComponents(2);
+  newTCoords->SetNumberOfTuples(numPts);
+
+  float* normals = newNormals->GetPointer(0);
+  float* tcoords = newTCoords->GetPointer(0);
+  for (vtkIdType k = 0; k < numPts; k++)
+  {
+    // The subdivided points are unit length by construction, so they serve
+    // directly as normals; scaling by Radius yields the positions.
+    const std::array<double, 3>& p = unitPts[k];
+    newPoints->SetPoint(k, this->Radius * p[0], this->Radius * p[1], this->Radius * p[2]);
+    normals[3 * k] = static_cast<float>(p[0]);
+    normals[3 * k + 1] = static_cast<float>(p[1]);
+    normals[3 * k + 2] = static_cast<float>(p[2]);
+    tcoords[2 * k] = tcs[k][0];
+    tcoords[2 * k + 1] = tcs[k][1];
+  }
+
+  vtkCellArray* newPolys = vtkCellArray::New();
+  newPolys->AllocateExact(numPolys, 3 * numPolys);
+  for (const auto& f : faces)
+  {
+    newPolys->InsertNextCell(3, f.data());
+  }
+
   output->SetPoints(newPoints);
   newPoints->Delete();
-
   output->GetPointData()->SetNormals(newNormals);
   newNormals->Delete();
-
   output->GetPointData()->SetTCoords(newTCoords);
   newTCoords->Delete();
-
   output->SetPolys(newPolys);
   newPolys->Delete();
-
-  return 1;
 }
 
 void vtkTexturedSphereSource::PrintSelf(ostream& os, vtkIndent indent)
@@ -156,6 +686,10 @@ void vtkTexturedSphereSource::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Theta: " << this->Theta << "\n";
   os << indent << "Phi: " << this->Phi << "\n";
   os << indent << "Radius: " << this->Radius << "\n";
+  os << indent << "Tessellation Mode: "
+     << (this->TessellationMode == ICOSAHEDRON_SUBDIVISION ? "IcosahedronSubdivision" : "UVSphere")
+     << "\n";
+  os << indent << "Subdivision Level: " << this->SubdivisionLevel << "\n";
   os << indent << "Output Points Precision: " << this->OutputPointsPrecision << "\n";
 }
 VTK_ABI_NAMESPACE_END
@@ -9,6 +9,15 @@
  * the latitude (phi) and longitude (theta) directions can be specified.
  * It also is possible to create partial sphere by specifying maximum phi and
  * theta angles.
+ *
+ * Two tessellations are available. The default UV sphere samples the
+ * latitude/longitude parameterization directly and emits its output as
+ * one triangle strip per longitude band; it is simple but oversamples
+ * the poles. The icosahedron subdivision mode starts from a
+ * regular icosahedron and repeatedly splits each edge at its midpoint,
+ * projecting new points onto the sphere, which produces near-uniform
+ * triangle quality with roughly a quarter of the vertices for equivalent
+ * angular resolution.
  */
 
 #ifndef vtkTexturedSphereSource_h
@@ -24,6 +33,12 @@ public:
   vtkTypeMacro(vtkTexturedSphereSource, vtkPolyDataAlgorithm);
   void PrintSelf(ostream& os, vtkIndent indent) override;
 
+  enum TessellationModes
+  {
+    UV_SPHERE = 0,
+    ICOSAHEDRON_SUBDIVISION
+  };
+
   /**
    * Construct sphere with radius=0.5 and default resolution 8 in both Phi
    * and Theta directions.
@@ -70,6 +85,36 @@ public:
   vtkGetMacro(Phi, double);
   ///@}
 
+  ///@{
+  /**
+   * Set/get how the sphere is tessellated. UV_SPHERE (the default) samples
+   * the latitude/longitude parameterization at PhiResolution x
+   * ThetaResolution. ICOSAHEDRON_SUBDIVISION subdivides a regular
+   * icosahedron SubdivisionLevel times; PhiResolution and ThetaResolution
+   * are ignored in that mode.
+   */
+  vtkSetClampMacro(TessellationMode, int, UV_SPHERE, ICOSAHEDRON_SUBDIVISION);
+  vtkGetMacro(TessellationMode, int);
+  void SetTessellationModeToUVSphere() { this->SetTessellationMode(UV_SPHERE); }
+  void SetTessellationModeToIcosahedronSubdivision()
+  {
+    this->SetTessellationMode(ICOSAHEDRON_SUBDIVISION);
+  }
+  ///@}
+
+  ///@{
+  /**
+   * Set/get the number of midpoint subdivisions applied to the base
+   * icosahedron when TessellationMode is ICOSAHEDRON_SUBDIVISION. Level L
+   * produces 20*4^L triangles over 10*4^L+2 unique positions; the output
+   * contains a few additional points because positions along the texture
+   * seam and at the poles are duplicated to carry distinct texture
+   * coordinates.
+   */
+  vtkSetClampMacro(SubdivisionLevel, int, 0, 10);
+  vtkGetMacro(SubdivisionLevel, int);
+  ///@}
+
   ///@{
   /**
    * Set/get the desired precision for the output points.
@@ -85,11 +130,19 @@ protected:
   ~vtkTexturedSphereSource() override = default;
 
   int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+
+  /**
+   * Generate the output for ICOSAHEDRON_SUBDIVISION mode.
+   */
+  void GenerateIcosahedralSphere(vtkPolyData* output);
+
   double Radius;
   double Theta;
   double Phi;
   int ThetaResolution;
   int PhiResolution;
+  int TessellationMode;
+  int SubdivisionLevel;
   int OutputPointsPrecision;
 
 private:
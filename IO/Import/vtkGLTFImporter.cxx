@@ -68,10 +68,13 @@ vtkSmartPointer<vtkCamera> GLTFCameraToVTKCamera(const vtkGLTFDocumentLoader::Ca
 //------------------------------------------------------------------------------
 vtkSmartPointer<vtkTexture> CreateVTKTextureFromGLTFTexture(
   std::shared_ptr<vtkGLTFDocumentLoader::Model> model, int textureIndex,
-  std::map<int, vtkSmartPointer<vtkTexture>>& existingTextures)
+  std::vector<vtkSmartPointer<vtkTexture>>& existingTextures)
 {
-
-  if (existingTextures.count(textureIndex))
+  if (textureIndex >= static_cast<int>(existingTextures.size()))
+  {
+    existingTextures.resize(textureIndex + 1);
+  }
+  if (existingTextures[textureIndex])
   {
     return existingTextures[textureIndex];
   }
@@ -176,7 +179,7 @@ bool PrimitiveNeedsTangents(const std::shared_ptr<vtkGLTFDocumentLoader::Model>
 //------------------------------------------------------------------------------
 void ApplyGLTFMaterialToVTKActor(std::shared_ptr<vtkGLTFDocumentLoader::Model> model,
   vtkGLTFDocumentLoader::Primitive& primitive, vtkSmartPointer<vtkActor> actor,
-  std::map<int, vtkSmartPointer<vtkTexture>>& existingTextures)
+  std::vector<vtkSmartPointer<vtkTexture>>& existingTextures)
 {
   vtkGLTFDocumentLoader::Material& material = model->Materials[primitive.Material];
 
@@ -398,8 +401,11 @@ int vtkGLTFImporter::ImportBegin()
     return 0;
   }
 
-  this->EnabledAnimations.resize(this->GetNumberOfAnimations());
-  std::fill(std::begin(this->EnabledAnimations), std::end(this->EnabledAnimations), false);
+  // Pre-size the texture table from the document so per-material lookups
+  // index directly by glTF texture id.
+  this->Textures.assign(this->Loader->GetInternalModel()->Textures.size(), nullptr);
+
+  this->EnabledAnimations.assign(this->GetNumberOfAnimations(), 0);
 
   return 1;
 }
@@ -427,7 +433,8 @@ void vtkGLTFImporter::ImportActors(vtkRenderer* renderer)
 
   this->OutputsDescription = "";
 
-  this->Actors.clear();
+  // One actor list per node, indexed directly by node id.
+  this->Actors.assign(model->Nodes.size(), std::vector<vtkSmartPointer<vtkActor>>());
 
   // Iterate over tree
   while (!nodeIdStack.empty())
@@ -531,10 +538,11 @@ void vtkGLTFImporter::ImportCameras(vtkRenderer* renderer)
   }
 
   this->Cameras.clear();
+  this->Cameras.reserve(model->Cameras.size());
   for (size_t i = 0; i < model->Cameras.size(); i++)
   {
     vtkGLTFDocumentLoader::Camera const& camera = model->Cameras[i];
-    this->Cameras[static_cast<int>(i)] = GLTFCameraToVTKCamera(camera);
+    this->Cameras.push_back(GLTFCameraToVTKCamera(camera));
   }
 
   // Iterate over tree
@@ -736,45 +744,49 @@ void vtkGLTFImporter::ApplySkinningMorphing()
       vtkGLTFDocumentLoader::ComputeJointMatrices(*model, model->Skins[node.Skin], node, jointMats);
     }
 
-    for (const auto& actor : this->Actors[nodeId])
+    if (nodeId < static_cast<int>(this->Actors.size()))
     {
-      actor->SetUserMatrix(node.GlobalTransform);
+      for (const auto& actor : this->Actors[nodeId])
+      {
+        actor->SetUserMatrix(node.GlobalTransform);
 
-      vtkShaderProperty* shaderProp = actor->GetShaderProperty();
-      vtkUniforms* uniforms = shaderProp->GetVertexCustomUniforms();
-      uniforms->RemoveAllUniforms();
+        vtkShaderProperty* shaderProp = actor->GetShaderProperty();
+        vtkUniforms* uniforms = shaderProp->GetVertexCustomUniforms();
+        uniforms->RemoveAllUniforms();
 
-      if (!jointMats.empty())
-      {
-        std::vector<float> vec;
-        vec.reserve(16 * jointMats.size());
-        for (size_t i = 0; i < jointMats.size(); i++)
+        if (!jointMats.empty())
         {
-          vtkMatrix4x4* mat = jointMats[i];
-          for (int j = 0; j < 4; j++)
+          std::vector<float> vec;
+          vec.reserve(16 * jointMats.size());
+          for (size_t i = 0; i < jointMats.size(); i++)
           {
-            for (int k = 0; k < 4; k++)
+            vtkMatrix4x4* mat = jointMats[i];
+            for (int j = 0; j < 4; j++)
             {
-              vec.push_back(static_cast<float>(mat->GetElement(k, j)));
+              for (int k = 0; k < 4; k++)
+              {
+                vec.push_back(static_cast<float>(mat->GetElement(k, j)));
+              }
             }
           }
+          uniforms->SetUniformMatrix4x4v(
+            "jointMatrices", static_cast<int>(jointMats.size()), vec.data());
         }
-        uniforms->SetUniformMatrix4x4v(
-          "jointMatrices", static_cast<int>(jointMats.size()), vec.data());
-      }
 
-      if (!node.Weights.empty())
-      {
-        size_t nbWeights = vtkMath::Min<size_t>(node.Weights.size(), 4);
-        uniforms->SetUniform1fv("morphWeights", static_cast<int>(nbWeights), node.Weights.data());
-      }
-      else
-      {
-        vtkGLTFDocumentLoader::Mesh& mesh = model->Meshes[node.Mesh];
-        if (!mesh.Weights.empty())
+        if (!node.Weights.empty())
+        {
+          size_t nbWeights = vtkMath::Min<size_t>(node.Weights.size(), 4);
+          uniforms->SetUniform1fv("morphWeights", static_cast<int>(nbWeights), node.Weights.data());
+        }
+        else
         {
-          size_t nbWeights = vtkMath::Min<size_t>(mesh.Weights.size(), 4);
-          uniforms->SetUniform1fv("morphWeights", static_cast<int>(nbWeights), mesh.Weights.data());
+          vtkGLTFDocumentLoader::Mesh& mesh = model->Meshes[node.Mesh];
+          if (!mesh.Weights.empty())
+          {
+            size_t nbWeights = vtkMath::Min<size_t>(mesh.Weights.size(), 4);
+            uniforms->SetUniform1fv(
+              "morphWeights", static_cast<int>(nbWeights), mesh.Weights.data());
+          }
         }
       }
     }
@@ -817,7 +829,7 @@ void vtkGLTFImporter::EnableAnimation(vtkIdType animationIndex)
 {
   if (animationIndex >= 0 && animationIndex < this->GetNumberOfAnimations())
   {
-    this->EnabledAnimations[animationIndex] = true;
+    this->EnabledAnimations[animationIndex] = 1;
   }
 }
 
@@ -826,14 +838,14 @@ void vtkGLTFImporter::DisableAnimation(vtkIdType animationIndex)
 {
   if (animationIndex >= 0 && animationIndex < this->GetNumberOfAnimations())
   {
-    this->EnabledAnimations[animationIndex] = false;
+    this->EnabledAnimations[animationIndex] = 0;
   }
 }
 
 //----------------------------------------------------------------------------
 bool vtkGLTFImporter::IsAnimationEnabled(vtkIdType animationIndex)
 {
-  return this->EnabledAnimations[animationIndex];
+  return this->EnabledAnimations[animationIndex] != 0;
 }
 
 //----------------------------------------------------------------------------
@@ -877,12 +889,11 @@ void vtkGLTFImporter::PrintSelf(ostream& os, vtkIndent indent)
 //------------------------------------------------------------------------------
 vtkSmartPointer<vtkCamera> vtkGLTFImporter::GetCamera(unsigned int id)
 {
-  auto it = this->Cameras.find(id);
-  if (it == this->Cameras.end())
+  if (id >= this->Cameras.size())
   {
     vtkErrorMacro("Out of range camera index");
     return nullptr;
   }
-  return it->second;
+  return this->Cameras[id];
 }
 VTK_ABI_NAMESPACE_END
@@ -50,8 +50,8 @@
 #include "vtkImporter.h"
 #include "vtkSmartPointer.h" // For SmartPointer
 
-#include <map>    // For map
-#include <vector> // For vector
+#include <cstdint> // For uint8_t
+#include <vector>  // For vector
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkActor;
@@ -151,12 +151,17 @@ protected:
 
   char* FileName = nullptr;
 
-  std::map<int, vtkSmartPointer<vtkCamera>> Cameras;
-  std::map<int, vtkSmartPointer<vtkTexture>> Textures;
-  std::map<int, std::vector<vtkSmartPointer<vtkActor>>> Actors;
+  // glTF ids are dense indices into the document's arrays, so plain
+  // vectors indexed by id replace the former std::map containers; lookups
+  // are a single load instead of a tree walk.
+  std::vector<vtkSmartPointer<vtkCamera>> Cameras;
+  std::vector<vtkSmartPointer<vtkTexture>> Textures;
+  std::vector<std::vector<vtkSmartPointer<vtkActor>>> Actors;
   vtkSmartPointer<vtkGLTFDocumentLoader> Loader;
   std::string OutputsDescription;
-  std::vector<bool> EnabledAnimations;
+  // Byte-wide flags rather than std::vector<bool>, whose packed-bit proxy
+  // turns every per-frame read in UpdateTimeStep into a masked load+shift.
+  std::vector<uint8_t> EnabledAnimations;
   vtkIdType EnabledCamera = -1;
 
 private: